@@ -24,7 +24,14 @@ static void
 SPI_transfer(const uint8_t * tx, uint8_t * rx, uint8_t length)
 {
    // this function is called with SSEL=1, SCLK=0, and MOSI=0, and shall
-   // return in the same state
+   // return in the same state.
+   //
+   // The USI of the 4313 (DI/DO/USCK on PB5/PB6/PB7) cannot be used because
+   // those pins are occupied by the beeper jumper, the soft UART, and
+   // RFID_EN. The bit-banging below is therefore timed by the instructions
+   // themselves: every SCLK phase lasts at least 2 CPU cycles (≥ 540 ns
+   // at 3.6864 MHz), which is well within the TRF7970A SPI timing limits,
+   // giving an SPI clock of roughly 300 kHz.
 
    // start (assert nSSEL)
    //
@@ -32,27 +39,25 @@ SPI_transfer(const uint8_t * tx, uint8_t * rx, uint8_t length)
 
    for (uint8_t byte = 0; byte < length; ++byte)
        {
-         const uint8_t vtx = tx[byte];
+         uint8_t vtx = tx[byte];
          uint8_t vrx = 0;
-         for (uint8_t bit = 0x80; bit; bit >>= 1)
+         for (uint8_t bit = 0; bit < 8; ++bit)
              {
-               if (vtx & bit)   set_pin(B, MOSI);
-               else             clr_pin(B, MOSI);
-               set_pin(D, SCLK);                // ↑
-               _delay_ms(0.1);
-               vrx |= get_pin(D, MISO) & bit;   // sample Rx data
-               clr_pin(D,SCLK);                 // ↓
-               _delay_ms(0.2);
+               if (vtx & 0x80)   set_pin(B, MOSI);
+               else              clr_pin(B, MOSI);
+               vtx <<= 1;
+               set_pin(D, SCLK);                  // ↑
+               vrx <<= 1;
+               if (PIND & D_MISO)   vrx |= 1;     // sample Rx data
+               clr_pin(D, SCLK);                  // ↓
              }
          if (rx)   rx[byte] = vrx;
-         _delay_ms(0.5);
        }
 
-   // start (deassert SSEL)
+   // end (deassert SSEL)
    //
    clr_pin(B, MOSI);
    set_pin(D, SSEL);
-   sleep_ms(1);
 }
 //-----------------------------------------------------------------------------
 enum   // Table 6-20
@@ -119,6 +124,31 @@ enum Register_value
 
    ISO_MODE = ISO_MODE_high,
    ISO_FLAGS = ISO_FLAGS_high,
+
+   RX_NO_RESPONSE_WAIT = 0x30,   // × 37.76 µs = 1.8 ms
+};
+//-----------------------------------------------------------------------------
+enum IRQ_status   // bits of register IRQ_STATUS
+{
+   IRQ_TX          = 0x80,   // end of Tx
+   IRQ_RX          = 0x40,   // end of Rx
+   IRQ_FIFO        = 0x20,   // FIFO level reached (during Tx or Rx)
+   IRQ_CRC         = 0x10,   // CRC error
+   IRQ_PARITY      = 0x08,   // parity error
+   IRQ_FRAMING     = 0x04,   // byte framing or EOF error
+   IRQ_COLLISION   = 0x02,   // collision error
+   IRQ_NO_RESPONSE = 0x01,   // no response within RX_NO_RESPONSE_WAIT_TIME
+};
+//-----------------------------------------------------------------------------
+enum RFID_timing   // ISO 15693, high data rate, 1 out of 4 coding (ms)
+{
+   TX_ms          = 3,   // longest command frame (~9 bytes at 26.48 kbit/s)
+   NO_RESPONSE_ms = (RX_NO_RESPONSE_WAIT * 3776L + 99999) / 100000,
+   RX_BYTE_us     = 302, // one response byte (8 bits at 26.48 kbit/s)
+
+   /// max. time from sending a command until the reader must have reported
+   /// either Rx end or no response (not counting the response itself).
+   RESPONSE_ms    = TX_ms + NO_RESPONSE_ms + 1,
 };
 //-----------------------------------------------------------------------------
 const uint8_t fifo[1 + MAX_FIFO] = { READ | CONT | FIFO, 0 };
@@ -156,6 +186,7 @@ init_RFID_reader()
 {
    DirectCommand(CMD_init);
    DirectCommand(CMD_idle);
+   _delay_ms(1);   // SPI_transfer() no longer pauses after each command
 
    Reset_FIFO();
 
@@ -177,7 +208,7 @@ const uint8_t setup[] =
     0xC1,        // TX_TIMER_EPC_HIGH
     0xBB,        // TX_TIMER_EPC_LOW
     0x00,        // TX_PULSE_LENGTH_CONTROL
-    0x30,        // RX_NO_RESPONSE_WAIT_TIME
+    RX_NO_RESPONSE_WAIT,   // RX_NO_RESPONSE_WAIT_TIME
     0x1F,        // RX_WAIT_TIME
     0x01,        // MODULATOR_CONTROL
     0x40,        // RX_SPECIAL_SETTINGS = 424-kHz subcarrier for ISO 15693
@@ -211,4 +242,26 @@ uint8_t cmd[] = { uint8_t(READ | CONT | 0x0C),
    return cmd[1];
 }
 //-----------------------------------------------------------------------------
+/// wait until the reader has completed a transceive, i.e. until it reports
+/// Rx end or no response, for at most RESPONSE_ms + \b rx_ms. Return the
+/// IRQ status bits seen in the meantime.
+///
+/// The IRQ output of the reader is not connected to the 4313 (the IRQ_SEL
+/// jumper is opened, see hardware/README.reader-modification) so the IRQ
+/// status register is polled instead, sleeping 1 ms between polls.
+static uint8_t
+wait_RFID(uint8_t rx_ms)
+{
+uint8_t istat = 0;
+   for (uint8_t ms = RESPONSE_ms + rx_ms; ms; --ms)
+       {
+         sleep_ms(1);
+         const uint8_t is = read_ISR();
+         istat |= is;
+         if (is & IRQ_NO_RESPONSE)            break;
+         if ((is & (IRQ_RX | IRQ_FIFO)) == IRQ_RX)   break;
+       }
 
+   return istat;
+}
+//-----------------------------------------------------------------------------
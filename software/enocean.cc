@@ -224,7 +224,7 @@ crc = 0;
 }
 //-----------------------------------------------------------------------------
 static void
-transmit_changed_values(uint8_t from)
+transmit_changed_values()
 {
    // message has 1 + (CB_LEN + changed_idx) bytes:
    //
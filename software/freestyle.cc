@@ -503,10 +503,10 @@ read_Block(uint8_t block)
    iso_read_block[sizeof(iso_read_block) - 1] = block;
    SPI_transfer(iso_read_block, 0, sizeof(iso_read_block));
 
-   sleep_ms(30);
-
-const uint8_t istat = read_ISR();
-   if ((istat & 0xC0) != 0xC0)
+   // response: flags + 8 data bytes + 2 CRC bytes
+   //
+const uint8_t istat = wait_RFID((11*RX_BYTE_us)/1000 + 1);
+   if ((istat & (IRQ_TX | IRQ_RX)) != (IRQ_TX | IRQ_RX))
       {
          print1(15, istat);
          print1(16, block);